@@ -42,6 +42,24 @@ static void rnd_init() {
   TCNT0 = 0;             // init counter
 }
 
+// TIMER-BASED FRAME PACING --------------------------------------------------
+
+#define FRAME_PERIOD_MS 30
+#define FRAME_TIMER_TICKS (F_CPU / 1024 * FRAME_PERIOD_MS / 1000)
+
+static void frame_timer_init() {
+  TCCR1A = 0;
+  TCCR1B = (1 << WGM12) | (1 << CS12) | (1 << CS10);  // CTC mode, @FCPU/1024
+  OCR1A = FRAME_TIMER_TICKS - 1;                       // one match per frame
+  TCNT1 = 0;                                           // init counter
+}
+
+static void frame_timer_wait() {
+  while (!(TIFR & (1 << OCF1A))) {
+  }
+  TIFR = 1 << OCF1A;  // clear match flag by writing 1
+}
+
 // LCD HELPERS ---------------------------------------------------------------
 
 #define CLR_DISP 0x00000001
@@ -163,20 +181,13 @@ static void lcd_send_line2(char *str) {
 
 #define STARTING_PROJECTILE_H_POS 5
 
-#define CANNON_CG_IDX 0
-#define CANNON_PROJ_CG_IDX 1
-#define INVADER_PROJ_CG_IDX 2
+#define CG_SLOT_COUNT 8
 
 #define MAX_INVADER_Y 4
 #define MAX_INVADER_X 15
 #define MIN_INVADER_X 1
 #define START_INVADER_X 6
 
-#define DOUBLE_INVADER_CG_IDX 3
-#define TOP_ONLY_INVADER_CG_IDX 4
-#define BOT_ONLY_INVADER_CG_IDX 5
-#define PROJ_INVADER_COMB_CG_IDX 6
-
 typedef enum {
   BUTTON1 = 0,
   BUTTON2 = 1,
@@ -208,6 +219,17 @@ typedef struct {
   bool isActive;
 } CannonProjectileData;
 
+// Pixel rows of every character cell composed for the next frame
+typedef struct {
+  uint8_t cellRows[SCREEN_CH_HEIGHT][SCREEN_CH_WIDTH][CHAR_HEIGHT];
+} Frame;
+
+// What the LCD is currently showing, used to only send what changed
+typedef struct {
+  uint8_t cgRows[CG_SLOT_COUNT][CHAR_HEIGHT];
+  uint8_t ddChars[SCREEN_CH_HEIGHT][SCREEN_CH_WIDTH];
+} Compositor;
+
 static uint8_t const INVADER_SPRITES[][CHAR_HEIGHT] = {{
                                                            0b01101,
                                                            0b00010,
@@ -245,10 +267,6 @@ static int8_t clamp(int8_t const val, int8_t const min, int8_t const max) {
   return val;
 }
 
-static int8_t max(int8_t const val1, int8_t const val2) {
-  return val1 > val2 ? val1 : val2;
-}
-
 static bool is_cannon_proj_active(CannonProjectileData const *const data) {
   return data->isActive;
 }
@@ -268,10 +286,6 @@ static bool is_cannon_projectile_out(CannonProjectileData const *const data) {
   return data->pxPos.x >= SCREEN_PX_WIDTH;
 }
 
-static uint8_t get_dd_row_addr_from_px_y(int8_t const yPx) {
-  return yPx >= SCREEN_PX_HEIGHT / 2 ? DD_RAM_ADDR2 : DD_RAM_ADDR;
-}
-
 static int8_t find_first_zero(uint8_t const *const arr, int8_t const sz) {
   for (int i = 0; i < sz; i++) {
     if (arr[i] == 0) {
@@ -296,78 +310,7 @@ static InvaderDirection get_next_invader_direction(InvaderDirection const dir) {
   }
 }
 
-static void update_sprites_in_cg(int8_t const spriteIdx,
-                                 int8_t const heightOffset,
-                                 int8_t const invaderSpriteHeight) {
-  lcd_send_command(CG_RAM_ADDR + DOUBLE_INVADER_CG_IDX * CHAR_HEIGHT);
-  for (int i = 0; i < CHAR_HEIGHT; i++) {
-    lcd_send_data(0);
-  }
-
-  lcd_send_command(CG_RAM_ADDR + TOP_ONLY_INVADER_CG_IDX * CHAR_HEIGHT);
-  for (int i = 0; i < CHAR_HEIGHT; i++) {
-    lcd_send_data(0);
-  }
-
-  lcd_send_command(CG_RAM_ADDR + BOT_ONLY_INVADER_CG_IDX * CHAR_HEIGHT);
-  for (int i = 0; i < CHAR_HEIGHT; i++) {
-    lcd_send_data(0);
-  }
-
-  lcd_send_command(CG_RAM_ADDR + DOUBLE_INVADER_CG_IDX * CHAR_HEIGHT +
-                   heightOffset);
-  for (int i = 0; i < invaderSpriteHeight; i++) {
-    lcd_send_data(INVADER_SPRITES[spriteIdx][i]);
-  }
-
-  lcd_send_command(CG_RAM_ADDR + DOUBLE_INVADER_CG_IDX * CHAR_HEIGHT +
-                   invaderSpriteHeight + 1 + heightOffset);
-  for (int i = 0; i < invaderSpriteHeight; i++) {
-    lcd_send_data(INVADER_SPRITES[spriteIdx][i]);
-  }
-
-  lcd_send_command(CG_RAM_ADDR + TOP_ONLY_INVADER_CG_IDX * CHAR_HEIGHT +
-                   heightOffset);
-  for (int i = 0; i < invaderSpriteHeight; i++) {
-    lcd_send_data(INVADER_SPRITES[spriteIdx][i]);
-  }
-
-  lcd_send_command(CG_RAM_ADDR + BOT_ONLY_INVADER_CG_IDX * CHAR_HEIGHT +
-                   invaderSpriteHeight + 1 + heightOffset);
-  for (int i = 0; i < invaderSpriteHeight; i++) {
-    lcd_send_data(INVADER_SPRITES[spriteIdx][i]);
-  }
-}
-
-static void update_sprites_in_dd(
-    InvaderConfigFlags const configPerScreenChar[SCREEN_CH_HEIGHT]
-                                                [SCREEN_CH_WIDTH],
-    int8_t const updateMinX) {
-  for (int i = 0; i < SCREEN_CH_HEIGHT; i++) {
-    int const rowAddr = i == 0 ? DD_RAM_ADDR : DD_RAM_ADDR2;
-
-    for (int j = updateMinX; j < SCREEN_CH_WIDTH; j++) {
-      lcd_send_command(rowAddr + j);
-
-      bool const hasTop =
-          (configPerScreenChar[i][j] & INVADER_CONFIG_FLAG_TOP) != 0;
-      bool const hasBot =
-          (configPerScreenChar[i][j] & INVADER_CONFIG_FLAG_BOT) != 0;
-
-      if (hasTop && hasBot) {
-        lcd_send_data(DOUBLE_INVADER_CG_IDX);
-      } else if (hasTop) {
-        lcd_send_data(TOP_ONLY_INVADER_CG_IDX);
-      } else if (hasBot) {
-        lcd_send_data(BOT_ONLY_INVADER_CG_IDX);
-      } else {
-        lcd_send_data(' ');
-      }
-    }
-  }
-}
-
-static void shift_sprites_left_in_dd(
+static void shift_invaders_left(
     InvaderConfigFlags configPerScreenChar[SCREEN_CH_HEIGHT][SCREEN_CH_WIDTH]) {
   for (int i = 0; i < SCREEN_CH_HEIGHT; i++) {
     for (int j = 0; j < SCREEN_CH_WIDTH - 1; j++) {
@@ -401,33 +344,170 @@ static int8_t calculate_invader_sprite_height(int8_t const invaderSpriteIdx) {
   return find_first_zero(INVADER_SPRITES[invaderSpriteIdx], CHAR_HEIGHT);
 }
 
-static void get_sprite_cg_char_from_config(uint8_t dstBytes[CHAR_HEIGHT],
-                                           InvaderConfigFlags const configFlags,
-                                           int8_t const spriteIdx,
-                                           int8_t const spriteHeight,
-                                           int8_t const spriteYOffset) {
-  if ((configFlags & INVADER_CONFIG_FLAG_TOP) != INVADER_CONFIG_FLAG_NONE) {
-    memcpy(dstBytes + spriteYOffset, INVADER_SPRITES[spriteIdx], spriteHeight);
+static void frame_clear(Frame *const frame) {
+  memset(frame->cellRows, 0, sizeof(frame->cellRows));
+}
+
+static void frame_draw_px(Frame *const frame, Point const pxPos) {
+  frame->cellRows[pxPos.y / CHAR_HEIGHT][pxPos.x / CHAR_WIDTH]
+                 [pxPos.y % CHAR_HEIGHT] |=
+      1 << (CHAR_WIDTH - pxPos.x % CHAR_WIDTH - 1);
+}
+
+static void frame_draw_invaders(
+    Frame *const frame,
+    InvaderConfigFlags const configFlags[SCREEN_CH_HEIGHT][SCREEN_CH_WIDTH],
+    int8_t const spriteIdx, int8_t const spriteHeight,
+    int8_t const spriteYOffset) {
+  for (int i = 0; i < SCREEN_CH_HEIGHT; i++) {
+    for (int j = 0; j < SCREEN_CH_WIDTH; j++) {
+      uint8_t *const rows = frame->cellRows[i][j];
+
+      for (int k = 0; k < spriteHeight; k++) {
+        if ((configFlags[i][j] & INVADER_CONFIG_FLAG_TOP) != 0) {
+          rows[spriteYOffset + k] |= INVADER_SPRITES[spriteIdx][k];
+        }
+        if ((configFlags[i][j] & INVADER_CONFIG_FLAG_BOT) != 0) {
+          rows[spriteYOffset + spriteHeight + 1 + k] |=
+              INVADER_SPRITES[spriteIdx][k];
+        }
+      }
+    }
   }
-  if ((configFlags & INVADER_CONFIG_FLAG_BOT) != INVADER_CONFIG_FLAG_NONE) {
-    memcpy(dstBytes + spriteYOffset + spriteHeight + 1,
-           INVADER_SPRITES[spriteIdx], spriteHeight);
+}
+
+static bool is_cell_empty(uint8_t const rows[CHAR_HEIGHT]) {
+  for (int i = 0; i < CHAR_HEIGHT; i++) {
+    if (rows[i] != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Call after the screen was cleared through the DD RAM
+static void compositor_reset(Compositor *const comp) {
+  // Slots are never assigned empty glyphs, so zeroed slots always get written
+  memset(comp->cgRows, 0, sizeof(comp->cgRows));
+  memset(comp->ddChars, ' ', sizeof(comp->ddChars));
+}
+
+static void compositor_write_cg_slot(Compositor *const comp, int8_t const slot,
+                                     uint8_t const rows[CHAR_HEIGHT]) {
+  lcd_send_command(CG_RAM_ADDR + slot * CHAR_HEIGHT);
+  for (int i = 0; i < CHAR_HEIGHT; i++) {
+    lcd_send_data(rows[i]);
   }
+  memcpy(comp->cgRows[slot], rows, CHAR_HEIGHT);
 }
 
-static uint8_t get_dd_value_from_config(InvaderConfigFlags const configFlags) {
-  bool const hasTop = configFlags & INVADER_CONFIG_FLAG_TOP;
-  bool const hasBot = configFlags & INVADER_CONFIG_FLAG_BOT;
-  return hasTop && hasBot ? DOUBLE_INVADER_CG_IDX
-         : hasTop         ? TOP_ONLY_INVADER_CG_IDX
-         : hasBot         ? BOT_ONLY_INVADER_CG_IDX
-                          : ' ';
+// Assigns a CG slot to every distinct non-empty cell of the frame, then sends
+// only the CG slots and DD characters that differ from what is on the screen.
+static void compositor_present(Compositor *const comp,
+                               Frame const *const frame) {
+  // Distinct glyphs of the frame, referenced by the first cell showing them
+  Point glyphCells[CG_SLOT_COUNT];
+  int8_t glyphSlots[CG_SLOT_COUNT];
+  int8_t glyphCount = 0;
+  int8_t glyphPerCell[SCREEN_CH_HEIGHT][SCREEN_CH_WIDTH];
+  bool slotTaken[CG_SLOT_COUNT] = {false};
+
+  for (int i = 0; i < SCREEN_CH_HEIGHT; i++) {
+    for (int j = 0; j < SCREEN_CH_WIDTH; j++) {
+      uint8_t const *const rows = frame->cellRows[i][j];
+      glyphPerCell[i][j] = -1;
+
+      if (is_cell_empty(rows)) {
+        continue;
+      }
+
+      for (int g = 0; g < glyphCount; g++) {
+        if (memcmp(frame->cellRows[glyphCells[g].y][glyphCells[g].x], rows,
+                   CHAR_HEIGHT) == 0) {
+          glyphPerCell[i][j] = g;
+          break;
+        }
+      }
+
+      // Cells beyond the available slots are left blank
+      if (glyphPerCell[i][j] == -1 && glyphCount < CG_SLOT_COUNT) {
+        glyphCells[glyphCount].x = j;
+        glyphCells[glyphCount].y = i;
+        glyphSlots[glyphCount] = -1;
+        glyphPerCell[i][j] = glyphCount++;
+      }
+    }
+  }
+
+  // Reuse slots already holding the glyph
+  for (int g = 0; g < glyphCount; g++) {
+    uint8_t const *const rows =
+        frame->cellRows[glyphCells[g].y][glyphCells[g].x];
+
+    for (int s = 0; s < CG_SLOT_COUNT; s++) {
+      if (!slotTaken[s] && memcmp(comp->cgRows[s], rows, CHAR_HEIGHT) == 0) {
+        glyphSlots[g] = s;
+        slotTaken[s] = true;
+        break;
+      }
+    }
+  }
+
+  // Redefine the slot the glyph's cell showed before, so animating sprites
+  // only cost a CG write and no DD writes
+  for (int g = 0; g < glyphCount; g++) {
+    uint8_t const prevChar = comp->ddChars[glyphCells[g].y][glyphCells[g].x];
+
+    if (glyphSlots[g] == -1 && prevChar < CG_SLOT_COUNT &&
+        !slotTaken[prevChar]) {
+      glyphSlots[g] = prevChar;
+      slotTaken[prevChar] = true;
+      compositor_write_cg_slot(
+          comp, prevChar, frame->cellRows[glyphCells[g].y][glyphCells[g].x]);
+    }
+  }
+
+  // Put the rest into any free slot
+  for (int g = 0; g < glyphCount; g++) {
+    for (int s = 0; glyphSlots[g] == -1 && s < CG_SLOT_COUNT; s++) {
+      if (!slotTaken[s]) {
+        glyphSlots[g] = s;
+        slotTaken[s] = true;
+        compositor_write_cg_slot(
+            comp, s, frame->cellRows[glyphCells[g].y][glyphCells[g].x]);
+      }
+    }
+  }
+
+  // The address counter is unknown until the first DD address is set
+  int16_t lcdAddr = -1;
+
+  for (int i = 0; i < SCREEN_CH_HEIGHT; i++) {
+    int const rowAddr = i == 0 ? DD_RAM_ADDR : DD_RAM_ADDR2;
+
+    for (int j = 0; j < SCREEN_CH_WIDTH; j++) {
+      uint8_t const ddChar =
+          glyphPerCell[i][j] == -1 ? ' ' : glyphSlots[glyphPerCell[i][j]];
+
+      if (ddChar == comp->ddChars[i][j]) {
+        continue;
+      }
+
+      if (lcdAddr != rowAddr + j) {
+        lcd_send_command(rowAddr + j);
+      }
+      lcd_send_data(ddChar);
+      lcdAddr = rowAddr + j + 1;  // entry mode increments the address
+      comp->ddChars[i][j] = ddChar;
+    }
+  }
 }
 
 int main() {
   port_init();
   lcd_init();
   rnd_init();
+  frame_timer_init();
 
   lcd_send_line1("  MinInvaders   ");
   lcd_send_line2(" Press a button ");
@@ -461,17 +541,22 @@ int main() {
 
     CannonProjectileData cannonProjData = {.pxPos = {0, 0}, .isActive = false};
 
+    Frame frame;
+    Compositor compositor;
+    compositor_reset(&compositor);
+
     for (int i = 0; i < SCREEN_CH_HEIGHT; i++) {
-      for (int j = START_INVADER_X; j < SCREEN_CH_WIDTH; j++) {
-        invaderConfigPerScreenChar[i][j] =
-            INVADER_CONFIG_FLAG_BOT | INVADER_CONFIG_FLAG_TOP;
-        livingInvaderCount += 2;
+      for (int j = 0; j < SCREEN_CH_WIDTH; j++) {
+        if (j < START_INVADER_X) {
+          invaderConfigPerScreenChar[i][j] = INVADER_CONFIG_FLAG_NONE;
+        } else {
+          invaderConfigPerScreenChar[i][j] =
+              INVADER_CONFIG_FLAG_BOT | INVADER_CONFIG_FLAG_TOP;
+          livingInvaderCount += 2;
+        }
       }
     }
 
-    update_sprites_in_dd(invaderConfigPerScreenChar, START_INVADER_X);
-    update_sprites_in_cg(invaderSpriteIdx, invaderYOffset, invaderSpriteHeight);
-
     while (true) {
       // Update invader sprites
       if (invaderUpdateCycles > invaderUpdateCycleThresh) {
@@ -484,10 +569,8 @@ int main() {
           invaderYOffset = 0;
         } else if (currentInvaderDir == INVADER_DIRECTION_SIDE_FROM_DOWN ||
                    currentInvaderDir == INVADER_DIRECTION_SIDE_FROM_UP) {
-          shift_sprites_left_in_dd(invaderConfigPerScreenChar);
+          shift_invaders_left(invaderConfigPerScreenChar);
           --currentInvaderStartX;
-          update_sprites_in_dd(invaderConfigPerScreenChar,
-                               currentInvaderStartX);
           invaderUpdateCycleThresh -= invaderUpdateCycles * 0.1f;
 
           if (currentInvaderStartX == 0) {
@@ -496,13 +579,11 @@ int main() {
           }
         }
 
-        update_sprites_in_cg(invaderSpriteIdx, invaderYOffset,
-                             invaderSpriteHeight);
         invaderUpdateCycles = 0;
         currentInvaderDir = get_next_invader_direction(currentInvaderDir);
       }
 
-      // Update and redraw cannon
+      // Update cannon
 
       int8_t const cannonRowPosOffset = is_button_down(BUTTON1)   ? -1
                                         : is_button_down(BUTTON5) ? 1
@@ -510,18 +591,7 @@ int main() {
       cannonPxPosY =
           clamp(cannonPxPosY + cannonRowPosOffset, 0, SCREEN_PX_HEIGHT - 1);
 
-      lcd_send_command(CG_RAM_ADDR + CANNON_CG_IDX * CHAR_HEIGHT);
-      for (int i = 0; i < CHAR_HEIGHT; i++) {
-        lcd_send_data(i == cannonPxPosY % CHAR_HEIGHT ? 1 : 0);
-      }
-
-      bool const cannonInBotHalf = cannonPxPosY >= SCREEN_PX_HEIGHT / 2;
-      lcd_send_command(DD_RAM_ADDR);
-      lcd_send_data(cannonInBotHalf ? ' ' : CANNON_CG_IDX);
-      lcd_send_command(DD_RAM_ADDR2);
-      lcd_send_data(cannonInBotHalf ? CANNON_CG_IDX : ' ');
-
-      // Calculate collision, then update and redraw cannon projectile
+      // Calculate collision, then update cannon projectile
 
       if (!is_cannon_proj_active(&cannonProjData)) {
         if (is_button_down(BUTTON3)) {
@@ -529,108 +599,57 @@ int main() {
         }
       } else {
         cannonProjData.pxPos.x += 1;
-        Point const projCharPos = {cannonProjData.pxPos.x / CHAR_WIDTH,
-                                   cannonProjData.pxPos.y / CHAR_HEIGHT};
-        Point const projLocalPxPos = {cannonProjData.pxPos.x % CHAR_WIDTH,
-                                      cannonProjData.pxPos.y % CHAR_HEIGHT};
-        uint8_t const projRowAddr =
-            get_dd_row_addr_from_px_y(cannonProjData.pxPos.y);
 
         if (is_cannon_projectile_out(&cannonProjData)) {
           set_cannon_projectile_inactive(&cannonProjData);
-          lcd_send_command(projRowAddr + SCREEN_CH_WIDTH - 1);
-          lcd_send_data(get_dd_value_from_config(
-              invaderConfigPerScreenChar[projCharPos.y][SCREEN_CH_WIDTH - 1]));
         } else {
+          Point const projCharPos = {cannonProjData.pxPos.x / CHAR_WIDTH,
+                                     cannonProjData.pxPos.y / CHAR_HEIGHT};
+          Point const projLocalPxPos = {cannonProjData.pxPos.x % CHAR_WIDTH,
+                                        cannonProjData.pxPos.y % CHAR_HEIGHT};
           InvaderConfigFlags const projCharInvaderConfigFlags =
               invaderConfigPerScreenChar[projCharPos.y][projCharPos.x];
 
-          bool collision = false;
-
-          if (projCharInvaderConfigFlags != INVADER_CONFIG_FLAG_NONE) {
-            bool const hasTopInvader =
-                (projCharInvaderConfigFlags & INVADER_CONFIG_FLAG_TOP) != 0;
-            bool const hasBotInvader =
-                (projCharInvaderConfigFlags & INVADER_CONFIG_FLAG_BOT) != 0;
-            bool const collisionTop =
-                projLocalPxPos.y < CHAR_HEIGHT / 2 && hasTopInvader;
-            bool const collisionBot =
-                projLocalPxPos.y >= CHAR_HEIGHT / 2 && hasBotInvader;
-            collision = collisionTop || collisionBot;
-
-            if (collision) {
-              invaderConfigPerScreenChar[projCharPos.y][projCharPos.x] =
-                  hasTopInvader && hasBotInvader
-                      ? (collisionTop ? INVADER_CONFIG_FLAG_BOT
-                                      : INVADER_CONFIG_FLAG_TOP)
-                      : INVADER_CONFIG_FLAG_NONE;
-              update_sprites_in_dd(invaderConfigPerScreenChar,
-                                   currentInvaderStartX);
-              set_cannon_projectile_inactive(&cannonProjData);
-              currentInvaderStartX =
-                  recalculate_invader_start_x(invaderConfigPerScreenChar);
-              --livingInvaderCount;
-
-              if (livingInvaderCount == 0) {
-                gege = true;
-                break;
-              }
-
-              // Clear character under the despawned projectile
-
-              if (projCharPos.x > 1) {
-                lcd_send_command(projRowAddr + projCharPos.x - 1);
-                lcd_send_data(get_dd_value_from_config(
-                    invaderConfigPerScreenChar[projCharPos.y]
-                                              [projCharPos.x - 1]));
-              }
+          bool const hasTopInvader =
+              (projCharInvaderConfigFlags & INVADER_CONFIG_FLAG_TOP) != 0;
+          bool const hasBotInvader =
+              (projCharInvaderConfigFlags & INVADER_CONFIG_FLAG_BOT) != 0;
+          bool const collisionTop =
+              projLocalPxPos.y < CHAR_HEIGHT / 2 && hasTopInvader;
+          bool const collisionBot =
+              projLocalPxPos.y >= CHAR_HEIGHT / 2 && hasBotInvader;
+
+          if (collisionTop || collisionBot) {
+            invaderConfigPerScreenChar[projCharPos.y][projCharPos.x] =
+                hasTopInvader && hasBotInvader
+                    ? (collisionTop ? INVADER_CONFIG_FLAG_BOT
+                                    : INVADER_CONFIG_FLAG_TOP)
+                    : INVADER_CONFIG_FLAG_NONE;
+            set_cannon_projectile_inactive(&cannonProjData);
+            currentInvaderStartX =
+                recalculate_invader_start_x(invaderConfigPerScreenChar);
+            --livingInvaderCount;
+
+            if (livingInvaderCount == 0) {
+              gege = true;
+              break;
             }
           }
+        }
+      }
 
-          if (!collision) {
-            // Move cannon projectile forward inside a character
-
-            uint8_t const projPxRow = 1 << (CHAR_WIDTH - projLocalPxPos.x - 1);
-
-            if (projCharInvaderConfigFlags != INVADER_CONFIG_FLAG_NONE) {
-              lcd_send_command(projRowAddr + projCharPos.x);
-              lcd_send_data(PROJ_INVADER_COMB_CG_IDX);
-
-              uint8_t charRows[CHAR_HEIGHT] = {0};
-              get_sprite_cg_char_from_config(
-                  charRows, projCharInvaderConfigFlags, invaderSpriteIdx,
-                  invaderSpriteHeight, invaderYOffset);
-              charRows[projLocalPxPos.y] = projPxRow;
-
-              lcd_send_command(CG_RAM_ADDR +
-                               PROJ_INVADER_COMB_CG_IDX * CHAR_HEIGHT);
-              for (int i = 0; i < CHAR_HEIGHT; i++) {
-                lcd_send_data(charRows[i]);
-              }
-            } else {
-              lcd_send_command(projRowAddr + projCharPos.x);
-              lcd_send_data(CANNON_PROJ_CG_IDX);
-
-              lcd_send_command(CG_RAM_ADDR + CANNON_PROJ_CG_IDX * CHAR_HEIGHT);
-              for (int i = 0; i < CHAR_HEIGHT; i++) {
-                lcd_send_data(i == projLocalPxPos.y ? projPxRow : 0);
-              }
-            }
+      // Compose and redraw everything that changed
 
-            // Restore character behind projectile
-            if (projLocalPxPos.x == 0) {
-              int8_t const prevProjCharX = max(projCharPos.x - 1, 1);
-              InvaderConfigFlags const configFlagsPrevX =
-                  invaderConfigPerScreenChar[projCharPos.y][prevProjCharX];
-              lcd_send_command(projRowAddr + prevProjCharX);
-              lcd_send_data(get_dd_value_from_config(configFlagsPrevX));
-            } else {
-              lcd_send_data(' ');
-            }
-          }
-        }
+      frame_clear(&frame);
+      frame_draw_invaders(&frame, invaderConfigPerScreenChar, invaderSpriteIdx,
+                          invaderSpriteHeight, invaderYOffset);
+      frame_draw_px(&frame, (Point){CHAR_WIDTH - 1, cannonPxPosY});
+      if (is_cannon_proj_active(&cannonProjData)) {
+        frame_draw_px(&frame, cannonProjData.pxPos);
       }
+      compositor_present(&compositor, &frame);
 
+      frame_timer_wait();
       ++invaderUpdateCycles;
     }
 